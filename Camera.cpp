@@ -0,0 +1,71 @@
+#include "Camera.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+constexpr float kMinCellSize = 1.0f / 1024.0f;
+constexpr float kMaxCellSize = 256.0f;
+}
+
+void Camera::FitToGrid(const int rows, const int cols, const int viewW, const int viewH) {
+    if (rows <= 0 || cols <= 0 || viewW <= 0 || viewH <= 0)
+        return;
+
+    const float fit = std::min(static_cast<float>(viewW) / static_cast<float>(cols),
+                               static_cast<float>(viewH) / static_cast<float>(rows));
+    // Keep whole-pixel cells when they fit so grid lines stay crisp.
+    cellSize_ = std::clamp(fit >= 1.0f ? std::floor(fit) : fit, kMinCellSize, kMaxCellSize);
+    offsetX_ = std::floor((static_cast<float>(viewW) - cellSize_ * static_cast<float>(cols)) / 2.0f);
+    offsetY_ = std::floor((static_cast<float>(viewH) - cellSize_ * static_cast<float>(rows)) / 2.0f);
+}
+
+void Camera::Pan(const float dx, const float dy) {
+    offsetX_ += dx;
+    offsetY_ += dy;
+}
+
+void Camera::ZoomAt(const float factor, const float screenX, const float screenY) {
+    const float newSize = std::clamp(cellSize_ * factor, kMinCellSize, kMaxCellSize);
+    const float applied = newSize / cellSize_;
+    // Keep the grid point under the cursor fixed on screen.
+    offsetX_ = screenX - (screenX - offsetX_) * applied;
+    offsetY_ = screenY - (screenY - offsetY_) * applied;
+    cellSize_ = newSize;
+}
+
+float Camera::GetCellSize() const {
+    return cellSize_;
+}
+
+float Camera::GetOffsetX() const {
+    return offsetX_;
+}
+
+float Camera::GetOffsetY() const {
+    return offsetY_;
+}
+
+bool Camera::ScreenToCell(const float screenX, const float screenY, const int rows, const int cols, int& row,
+                          int& col) const {
+    const float c = std::floor((screenX - offsetX_) / cellSize_);
+    const float r = std::floor((screenY - offsetY_) / cellSize_);
+    if (r < 0.0f || c < 0.0f || r >= static_cast<float>(rows) || c >= static_cast<float>(cols))
+        return false;
+    row = static_cast<int>(r);
+    col = static_cast<int>(c);
+    return true;
+}
+
+CellRange Camera::VisibleCells(const int rows, const int cols, const int viewW, const int viewH) const {
+    CellRange range;
+    range.colBegin = static_cast<int>(std::clamp(std::floor(-offsetX_ / cellSize_), 0.0f, static_cast<float>(cols)));
+    range.rowBegin = static_cast<int>(std::clamp(std::floor(-offsetY_ / cellSize_), 0.0f, static_cast<float>(rows)));
+    range.colEnd = static_cast<int>(
+        std::clamp(std::ceil((static_cast<float>(viewW) - offsetX_) / cellSize_), 0.0f, static_cast<float>(cols)));
+    range.rowEnd = static_cast<int>(
+        std::clamp(std::ceil((static_cast<float>(viewH) - offsetY_) / cellSize_), 0.0f, static_cast<float>(rows)));
+    range.colEnd = std::max(range.colEnd, range.colBegin);
+    range.rowEnd = std::max(range.rowEnd, range.rowBegin);
+    return range;
+}
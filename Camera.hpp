@@ -0,0 +1,29 @@
+#pragma once
+
+struct CellRange {
+    int rowBegin = 0;
+    int rowEnd = 0;
+    int colBegin = 0;
+    int colEnd = 0;
+};
+
+class Camera {
+public:
+    void FitToGrid(int rows, int cols, int viewW, int viewH);
+
+    void Pan(float dx, float dy);
+    void ZoomAt(float factor, float screenX, float screenY);
+
+    float GetCellSize() const;
+    float GetOffsetX() const;
+    float GetOffsetY() const;
+
+    bool ScreenToCell(float screenX, float screenY, int rows, int cols, int& row, int& col) const;
+    CellRange VisibleCells(int rows, int cols, int viewW, int viewH) const;
+
+private:
+    // Pixels per cell and the screen position of cell (0, 0).
+    float cellSize_ = 1.0f;
+    float offsetX_ = 0.0f;
+    float offsetY_ = 0.0f;
+};
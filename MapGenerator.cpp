@@ -0,0 +1,398 @@
+#include "MapGenerator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+constexpr int kTileSize = 64;
+constexpr int kMazeBandRows = 32;
+constexpr int kBlockMinSize = 2;
+constexpr int kBlockMaxDivisor = 16;
+constexpr double kBlockCoverage = 0.15;
+constexpr double kBlockNoiseDensity = 1.0 / 12.0;
+constexpr double kNoiseDensity = 0.3;
+constexpr int kRoomTileDivisor = 4;
+constexpr int kRoomTileMinSize = 8;
+constexpr int kRoomTileMaxSize = 48;
+constexpr std::uint64_t kGolden = 0x9E3779B97F4A7C15ULL;
+
+// Separate streams keep the generators, and the different draws within one, from sharing random sequences.
+enum class Stream : std::uint64_t {
+    Blocks = 1,
+    BlockNoise,
+    Noise,
+    Maze,
+    Rooms,
+    RoomDoors
+};
+
+// SplitMix64 finalizer.
+std::uint64_t Mix(std::uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+std::uint64_t Key(const std::uint64_t seed, const Stream stream, const std::uint64_t a, const std::uint64_t b = 0) {
+    std::uint64_t h = Mix(seed + kGolden * static_cast<std::uint64_t>(stream));
+    h = Mix(h ^ (a + kGolden));
+    return Mix(h ^ (b + 2 * kGolden));
+}
+
+double ToUnit(const std::uint64_t bits) {
+    return static_cast<double>(bits >> 11) * 0x1.0p-53;
+}
+
+// Counter-based generator: the n-th value is a pure function of (key, n), so any tile can recreate its stream
+// without depending on what other tiles drew. std distributions are avoided because their output differs
+// between standard library implementations.
+class CounterRng {
+public:
+    explicit CounterRng(const std::uint64_t key) : key_(key) {}
+
+    std::uint64_t Next() {
+        return Mix(key_ ^ (kGolden * ++counter_));
+    }
+
+    // Uniform integer in [lo, hi].
+    int Range(const int lo, const int hi) {
+        if (hi <= lo)
+            return lo;
+        const std::uint64_t span = static_cast<std::uint64_t>(hi - lo) + 1;
+        return lo + static_cast<int>(((Next() >> 32) * span) >> 32);
+    }
+
+    bool Chance(const double p) {
+        return ToUnit(Next()) < p;
+    }
+
+private:
+    std::uint64_t key_ = 0;
+    std::uint64_t counter_ = 0;
+};
+
+double CellUnit(const std::uint64_t key, const int index) {
+    return ToUnit(Mix(key + kGolden * static_cast<std::uint64_t>(index)));
+}
+
+// Splits [0, extent) into equal parts no smaller than size (a single part if extent is smaller).
+struct Tiling {
+    int extent = 0;
+    int count = 1;
+
+    int Begin(const int tile) const {
+        return static_cast<int>(static_cast<long long>(tile) * extent / count);
+    }
+
+    int End(const int tile) const {
+        return Begin(tile + 1);
+    }
+};
+
+Tiling MakeTiling(const int extent, const int size) {
+    return {extent, std::max(1, extent / size)};
+}
+
+template <typename Task>
+void ParallelFor(const int taskCount, const int threads, Task&& task) {
+    int workers = threads > 0 ? threads : static_cast<int>(std::thread::hardware_concurrency());
+    workers = std::clamp(workers, 1, std::max(1, taskCount));
+
+    std::atomic next{0};
+    auto worker = [&] {
+        for (int t = next++; t < taskCount; t = next++)
+            task(t);
+    };
+
+    std::vector<std::jthread> pool;
+    pool.reserve(workers - 1);
+    for (int i = 1; i < workers; ++i)
+        pool.emplace_back(worker);
+    worker();
+}
+
+struct TileRect {
+    int r0 = 0;
+    int r1 = 0;
+    int c0 = 0;
+    int c1 = 0;
+
+    int Width() const {
+        return c1 - c0;
+    }
+
+    int Height() const {
+        return r1 - r0;
+    }
+};
+
+// Copies a tile-local obstacle mask into the graph in one pass, keeping start and target free.
+void WriteTile(Graph& graph, const TileRect& tile, const std::vector<char>& mask, const int startIdx,
+               const int targetIdx) {
+    for (int r = tile.r0; r < tile.r1; ++r)
+        for (int c = tile.c0; c < tile.c1; ++c) {
+            const int idx = graph.Index(r, c);
+            Node& node = graph.GetNode(idx);
+            if (idx == startIdx || idx == targetIdx) {
+                node.obstacle = false;
+                node.state = idx == startIdx ? NodeState::Start : NodeState::Target;
+                continue;
+            }
+            node.obstacle = mask[(r - tile.r0) * tile.Width() + (c - tile.c0)] != 0;
+            node.state = node.obstacle ? NodeState::Obstacle : NodeState::Unvisited;
+        }
+}
+
+void GenerateBlocks(Graph& graph, const MapSettings& settings, const int startIdx, const int targetIdx) {
+    const int rows = graph.GetRows();
+    const int cols = graph.GetCols();
+
+    const int maxSize = std::max(kBlockMinSize * 3, std::min(rows, cols) / kBlockMaxDivisor);
+    const double averageSize = (kBlockMinSize + maxSize) / 2.0;
+    const double blocksPerCell = kBlockCoverage / (averageSize * averageSize);
+
+    // Tiles are at least as large as a block, so a block only spills into the tiles right of and below its origin.
+    const int tileSize = std::max(kTileSize, maxSize);
+    const Tiling rowTiles = MakeTiling(rows, tileSize);
+    const Tiling colTiles = MakeTiling(cols, tileSize);
+    const std::uint64_t noiseKey = Key(settings.seed, Stream::BlockNoise, 0);
+
+    ParallelFor(rowTiles.count * colTiles.count, settings.threads, [&](const int task) {
+        const int tr = task / colTiles.count;
+        const int tc = task % colTiles.count;
+        const TileRect tile{rowTiles.Begin(tr), rowTiles.End(tr), colTiles.Begin(tc), colTiles.End(tc)};
+        std::vector<char> mask(static_cast<size_t>(tile.Width()) * tile.Height(), 0);
+
+        for (int otr = std::max(0, tr - 1); otr <= tr; ++otr)
+            for (int otc = std::max(0, tc - 1); otc <= tc; ++otc) {
+                const TileRect origin{rowTiles.Begin(otr), rowTiles.End(otr), colTiles.Begin(otc), colTiles.End(otc)};
+                CounterRng rng(Key(settings.seed, Stream::Blocks, otr, otc));
+
+                const double expected = blocksPerCell * origin.Width() * origin.Height();
+                const int count = static_cast<int>(expected) + (rng.Chance(expected - static_cast<int>(expected)) ? 1 : 0);
+                for (int i = 0; i < count; ++i) {
+                    const int blockH = rng.Range(kBlockMinSize, maxSize);
+                    const int blockW = rng.Range(kBlockMinSize, maxSize);
+                    const int startR = rng.Range(origin.r0, origin.r1 - 1);
+                    const int startC = rng.Range(origin.c0, origin.c1 - 1);
+
+                    for (int r = std::max(tile.r0, startR); r < std::min(tile.r1, startR + blockH); ++r)
+                        for (int c = std::max(tile.c0, startC); c < std::min(tile.c1, startC + blockW); ++c)
+                            mask[(r - tile.r0) * tile.Width() + (c - tile.c0)] = 1;
+                }
+            }
+
+        for (int r = tile.r0; r < tile.r1; ++r)
+            for (int c = tile.c0; c < tile.c1; ++c)
+                if (CellUnit(noiseKey, graph.Index(r, c)) < kBlockNoiseDensity)
+                    mask[(r - tile.r0) * tile.Width() + (c - tile.c0)] = 1;
+
+        WriteTile(graph, tile, mask, startIdx, targetIdx);
+    });
+}
+
+void GenerateNoise(Graph& graph, const MapSettings& settings, const int startIdx, const int targetIdx) {
+    const Tiling rowTiles = MakeTiling(graph.GetRows(), kTileSize);
+    const Tiling colTiles = MakeTiling(graph.GetCols(), kTileSize);
+    const std::uint64_t noiseKey = Key(settings.seed, Stream::Noise, 0);
+
+    ParallelFor(rowTiles.count * colTiles.count, settings.threads, [&](const int task) {
+        const int tr = task / colTiles.count;
+        const int tc = task % colTiles.count;
+        const TileRect tile{rowTiles.Begin(tr), rowTiles.End(tr), colTiles.Begin(tc), colTiles.End(tc)};
+        std::vector<char> mask(static_cast<size_t>(tile.Width()) * tile.Height(), 0);
+
+        for (int r = tile.r0; r < tile.r1; ++r)
+            for (int c = tile.c0; c < tile.c1; ++c)
+                mask[(r - tile.r0) * tile.Width() + (c - tile.c0)] =
+                    CellUnit(noiseKey, graph.Index(r, c)) < kNoiseDensity ? 1 : 0;
+
+        WriteTile(graph, tile, mask, startIdx, targetIdx);
+    });
+}
+
+// Sidewinder maze: maze cells sit on even rows and columns, with walls in between. Each maze row only depends on
+// its own random stream, so bands of rows are generated independently.
+void GenerateMaze(Graph& graph, const MapSettings& settings, const int startIdx, const int targetIdx) {
+    const int rows = graph.GetRows();
+    const int cols = graph.GetCols();
+    const int mazeRows = (rows + 1) / 2;
+    const int mazeCols = (cols + 1) / 2;
+    const Tiling bands = MakeTiling(mazeRows, kMazeBandRows);
+
+    ParallelFor(bands.count, settings.threads, [&](const int band) {
+        // Grid rows 2i - 1 (the wall above maze row i) and 2i belong to maze row i; on an even grid the last
+        // band also owns the trailing row and opens it under each maze cell.
+        const int i0 = bands.Begin(band);
+        const int i1 = bands.End(band);
+        const TileRect tile{std::max(0, 2 * i0 - 1), i1 == mazeRows ? rows : 2 * i1 - 1, 0, cols};
+        std::vector<char> mask(static_cast<size_t>(tile.Width()) * tile.Height(), 1);
+        auto open = [&](const int r, const int c) {
+            mask[(r - tile.r0) * tile.Width() + c] = 0;
+        };
+
+        for (int i = i0; i < i1; ++i) {
+            CounterRng rng(Key(settings.seed, Stream::Maze, i));
+            int runStart = 0;
+            for (int j = 0; j < mazeCols; ++j) {
+                open(2 * i, 2 * j);
+                if (j + 1 < mazeCols && (i == 0 || rng.Chance(0.5))) {
+                    open(2 * i, 2 * j + 1);
+                    continue;
+                }
+                if (i > 0)
+                    open(2 * i - 1, 2 * rng.Range(runStart, j));
+                runStart = j + 1;
+            }
+            // An even grid leaves a trailing wall column; open it beside each maze cell.
+            if (cols % 2 == 0)
+                open(2 * i, cols - 1);
+        }
+
+        if (i1 == mazeRows && rows % 2 == 0)
+            for (int j = 0; j < mazeCols; ++j)
+                open(rows - 1, 2 * j);
+
+        WriteTile(graph, tile, mask, startIdx, targetIdx);
+    });
+}
+
+// One room per tile. Corridors run from the room to a door on each inner tile edge; both tiles sharing an edge
+// derive the same door position, so corridors meet without either tile writing outside itself.
+void GenerateRooms(Graph& graph, const MapSettings& settings, const int startIdx, const int targetIdx) {
+    const int rows = graph.GetRows();
+    const int cols = graph.GetCols();
+    const int tileSize = std::clamp(std::min(rows, cols) / kRoomTileDivisor, kRoomTileMinSize, kRoomTileMaxSize);
+    const Tiling rowTiles = MakeTiling(rows, tileSize);
+    const Tiling colTiles = MakeTiling(cols, tileSize);
+
+    auto margin = [](const int extent) {
+        return extent >= 5 ? 1 : 0;
+    };
+
+    ParallelFor(rowTiles.count * colTiles.count, settings.threads, [&](const int task) {
+        const int tr = task / colTiles.count;
+        const int tc = task % colTiles.count;
+        const TileRect tile{rowTiles.Begin(tr), rowTiles.End(tr), colTiles.Begin(tc), colTiles.End(tc)};
+        std::vector<char> mask(static_cast<size_t>(tile.Width()) * tile.Height(), 1);
+
+        auto carveH = [&](const int r, const int ca, const int cb) {
+            for (int c = std::min(ca, cb); c <= std::max(ca, cb); ++c)
+                mask[(r - tile.r0) * tile.Width() + (c - tile.c0)] = 0;
+        };
+        auto carveV = [&](const int c, const int ra, const int rb) {
+            for (int r = std::min(ra, rb); r <= std::max(ra, rb); ++r)
+                mask[(r - tile.r0) * tile.Width() + (c - tile.c0)] = 0;
+        };
+
+        const int marginH = margin(tile.Height());
+        const int marginW = margin(tile.Width());
+        const int availH = tile.Height() - 2 * marginH;
+        const int availW = tile.Width() - 2 * marginW;
+
+        CounterRng rng(Key(settings.seed, Stream::Rooms, tr, tc));
+        const int roomH = rng.Range(std::max(1, availH / 2), availH);
+        const int roomW = rng.Range(std::max(1, availW / 2), availW);
+        const int roomR = tile.r0 + marginH + rng.Range(0, availH - roomH);
+        const int roomC = tile.c0 + marginW + rng.Range(0, availW - roomW);
+        for (int r = roomR; r < roomR + roomH; ++r)
+            carveH(r, roomC, roomC + roomW - 1);
+
+        const int centerR = roomR + roomH / 2;
+        const int centerC = roomC + roomW / 2;
+
+        // Vertical edges are keyed by (2 * row tile, left column tile), horizontal ones by (2 * upper row tile + 1, column tile).
+        auto doorRow = [&](const int edgeTc) {
+            CounterRng door(Key(settings.seed, Stream::RoomDoors, 2 * static_cast<std::uint64_t>(tr), edgeTc));
+            return door.Range(tile.r0 + marginH, tile.r1 - 1 - marginH);
+        };
+        auto doorCol = [&](const int edgeTr) {
+            CounterRng door(Key(settings.seed, Stream::RoomDoors, 2 * static_cast<std::uint64_t>(edgeTr) + 1, tc));
+            return door.Range(tile.c0 + marginW, tile.c1 - 1 - marginW);
+        };
+
+        if (tc + 1 < colTiles.count) {
+            const int dr = doorRow(tc);
+            carveV(centerC, centerR, dr);
+            carveH(dr, centerC, tile.c1 - 1);
+        }
+        if (tc > 0) {
+            const int dr = doorRow(tc - 1);
+            carveV(centerC, centerR, dr);
+            carveH(dr, tile.c0, centerC);
+        }
+        if (tr + 1 < rowTiles.count) {
+            const int dc = doorCol(tr);
+            carveH(centerR, centerC, dc);
+            carveV(dc, centerR, tile.r1 - 1);
+        }
+        if (tr > 0) {
+            const int dc = doorCol(tr - 1);
+            carveH(centerR, centerC, dc);
+            carveV(dc, tile.r0, centerR);
+        }
+
+        for (const int idx : {startIdx, targetIdx}) {
+            if (idx < 0 || idx >= rows * cols)
+                continue;
+            const Node& node = graph.GetNode(idx);
+            if (node.row < tile.r0 || node.row >= tile.r1 || node.col < tile.c0 || node.col >= tile.c1)
+                continue;
+            carveH(centerR, centerC, node.col);
+            carveV(node.col, centerR, node.row);
+        }
+
+        WriteTile(graph, tile, mask, startIdx, targetIdx);
+    });
+}
+}
+
+void GenerateMap(Graph& graph, const MapSettings& settings, const int startIdx, const int targetIdx) {
+    if (graph.GetRows() <= 0 || graph.GetCols() <= 0)
+        return;
+
+    switch (settings.kind) {
+        case MapKind::Blocks:
+            GenerateBlocks(graph, settings, startIdx, targetIdx);
+            break;
+        case MapKind::Noise:
+            GenerateNoise(graph, settings, startIdx, targetIdx);
+            break;
+        case MapKind::Maze:
+            GenerateMaze(graph, settings, startIdx, targetIdx);
+            break;
+        case MapKind::Rooms:
+            GenerateRooms(graph, settings, startIdx, targetIdx);
+            break;
+    }
+}
+
+const char* GetMapKindName(const MapKind kind) {
+    switch (kind) {
+        case MapKind::Blocks:
+            return "blocks";
+        case MapKind::Noise:
+            return "noise";
+        case MapKind::Maze:
+            return "maze";
+        case MapKind::Rooms:
+            return "rooms";
+        default:
+            return "unknown";
+    }
+}
+
+MapKind NextMapKind(const MapKind kind) {
+    switch (kind) {
+        case MapKind::Blocks:
+            return MapKind::Noise;
+        case MapKind::Noise:
+            return MapKind::Maze;
+        case MapKind::Maze:
+            return MapKind::Rooms;
+        default:
+            return MapKind::Blocks;
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Graph.hpp"
+
+enum class MapKind {
+    Blocks,
+    Noise,
+    Maze,
+    Rooms
+};
+
+struct MapSettings {
+    MapKind kind = MapKind::Blocks;
+    std::uint64_t seed = 0;
+    // Worker thread count; 0 uses the hardware concurrency. Does not affect the generated map.
+    int threads = 0;
+};
+
+// Overwrites every obstacle and state in the graph. The grid is split into tiles whose contents depend only on
+// the seed and the tile coordinates, so the result is identical for a given seed whatever the thread count.
+void GenerateMap(Graph& graph, const MapSettings& settings, int startIdx, int targetIdx);
+
+const char* GetMapKindName(MapKind kind);
+MapKind NextMapKind(MapKind kind);
@@ -1,46 +1,128 @@
 #include "Renderer.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace {
+constexpr float kGridLineMinCellSize = 4.0f;
+constexpr float kMinMarkerSize = 3.0f;
+constexpr int kLodSamplesPerBlock = 16;
+
+std::uint32_t HashBlock(const int row, const int col) {
+    std::uint32_t h = static_cast<std::uint32_t>(row) * 0x9E3779B1u ^ static_cast<std::uint32_t>(col) * 0x85EBCA77u;
+    h ^= h >> 15;
+    h *= 0x2C1B3C6Du;
+    h ^= h >> 12;
+    return h;
+}
+}
 
 Renderer::Renderer(SDL_Renderer* renderer) : renderer_(renderer) {}
 
-void Renderer::Render(const Graph& graph, const int startIdx, const int targetIdx) const {
-    (void)startIdx;
-    (void)targetIdx;
+void Renderer::Render(const Graph& graph, const Camera& camera, const int startIdx, const int targetIdx) const {
     int renderW = 0;
     int renderH = 0;
     SDL_GetRenderOutputSize(renderer_, &renderW, &renderH);
 
     const int rows = graph.GetRows();
     const int cols = graph.GetCols();
-
-    const int cellSize = std::max(1, std::min(renderW / cols, renderH / rows));
-    const int gridW = cellSize * cols;
-    const int gridH = cellSize * rows;
-    const int offsetX = (renderW - gridW) / 2;
-    const int offsetY = (renderH - gridH) / 2;
+    const float cellSize = camera.GetCellSize();
+    const float offsetX = camera.GetOffsetX();
+    const float offsetY = camera.GetOffsetY();
 
     SDL_SetRenderDrawColor(renderer_, 20, 20, 20, 255);
     SDL_RenderClear(renderer_);
 
-    for (const Node& node : graph.GetNodes()) {
-        auto [r, g, b, a] = GetColor(node.state);
-        SDL_SetRenderDrawColor(renderer_, r, g, b, a);
+    // When zoomed out, a block x block group of cells shares one screen pixel. Blocks are aligned to the grid so
+    // their contents do not shift while panning, and at most kLodSamplesPerBlock cells per block are sampled so
+    // the cost stays bounded by the screen size rather than the grid size.
+    const int block = cellSize >= 1.0f ? 1 : static_cast<int>(std::ceil(1.0f / cellSize));
+    const int samples = std::min(block, kLodSamplesPerBlock);
+    const float blockSize = static_cast<float>(block) * cellSize;
+
+    for (auto& batch : batches_)
+        batch.clear();
+
+    const auto [rowBegin, rowEnd, colBegin, colEnd] = camera.VisibleCells(rows, cols, renderW, renderH);
+    for (int r = rowBegin - rowBegin % block; r < rowEnd; r += block)
+        for (int c = colBegin - colBegin % block; c < colEnd; c += block) {
+            NodeState state = graph.GetNode(graph.Index(r, c)).state;
+            if (block > 1) {
+                // Rook sampling: each of the `samples` strips of rows and of columns holds exactly one sample, so a
+                // one-cell-wide wall, frontier or path line is never missed while the block is at most
+                // kLodSamplesPerBlock wide. Larger blocks jitter the sample inside each strip by a hash of the block
+                // position, which avoids lining up with periodic content yet stays stable while panning.
+                const std::uint32_t h = HashBlock(r / block, c / block);
+                const int jitterR = static_cast<int>(h % static_cast<std::uint32_t>(block));
+                const int jitterC = static_cast<int>((h >> 16) % static_cast<std::uint32_t>(block));
+                const int shift = static_cast<int>((h >> 8) % static_cast<std::uint32_t>(samples));
+                for (int i = 0; i < samples; ++i) {
+                    const int strip = (samples - 1 - i + shift) % samples;
+                    const int sr = r + (i * block + jitterR) / samples;
+                    const int sc = c + (strip * block + jitterC) / samples;
+                    if (sr >= rows || sc >= cols)
+                        continue;
+                    if (const NodeState sampled = graph.GetNode(graph.Index(sr, sc)).state;
+                        GetPriority(sampled) > GetPriority(state))
+                        state = sampled;
+                }
+            }
+
+            SDL_FRect rect;
+            rect.x = offsetX + static_cast<float>(c) * cellSize;
+            rect.y = offsetY + static_cast<float>(r) * cellSize;
+            rect.w = blockSize;
+            rect.h = blockSize;
+            batches_[static_cast<int>(state)].push_back(rect);
+        }
 
-        SDL_FRect rect;
-        rect.x = static_cast<float>(offsetX + node.col * cellSize);
-        rect.y = static_cast<float>(offsetY + node.row * cellSize);
-        rect.w = static_cast<float>(cellSize);
-        rect.h = static_cast<float>(cellSize);
-        SDL_RenderFillRect(renderer_, &rect);
+    for (int i = 0; i < kStateCount; ++i) {
+        if (batches_[i].empty())
+            continue;
+        auto [r, g, b, a] = GetColor(static_cast<NodeState>(i));
+        SDL_SetRenderDrawColor(renderer_, r, g, b, a);
+        SDL_RenderFillRects(renderer_, batches_[i].data(), static_cast<int>(batches_[i].size()));
+    }
 
+    if (cellSize >= kGridLineMinCellSize) {
         SDL_SetRenderDrawColor(renderer_, 30, 30, 30, 255);
-        SDL_RenderRect(renderer_, &rect);
+        for (const auto& batch : batches_)
+            if (!batch.empty())
+                SDL_RenderRects(renderer_, batch.data(), static_cast<int>(batch.size()));
     }
 
+    DrawMarker(graph, camera, startIdx);
+    DrawMarker(graph, camera, targetIdx);
+
     SDL_RenderPresent(renderer_);
 }
 
+void Renderer::DrawMarker(const Graph& graph, const Camera& camera, const int index) const {
+    if (index < 0 || index >= static_cast<int>(graph.GetNodes().size()))
+        return;
+
+    // Start and target stay visible at any zoom level, even when their block is summarised by another state.
+    const Node& node = graph.GetNode(index);
+    const float cellSize = camera.GetCellSize();
+    const float size = std::max(cellSize, kMinMarkerSize);
+
+    SDL_FRect rect;
+    rect.x = camera.GetOffsetX() + (static_cast<float>(node.col) + 0.5f) * cellSize - size / 2.0f;
+    rect.y = camera.GetOffsetY() + (static_cast<float>(node.row) + 0.5f) * cellSize - size / 2.0f;
+    rect.w = size;
+    rect.h = size;
+
+    auto [r, g, b, a] = GetColor(node.state);
+    SDL_SetRenderDrawColor(renderer_, r, g, b, a);
+    SDL_RenderFillRect(renderer_, &rect);
+
+    if (cellSize >= kGridLineMinCellSize) {
+        SDL_SetRenderDrawColor(renderer_, 30, 30, 30, 255);
+        SDL_RenderRect(renderer_, &rect);
+    }
+}
+
 SDL_Color Renderer::GetColor(const NodeState state) {
     switch (state) {
         case NodeState::Unvisited:
@@ -63,3 +145,26 @@ SDL_Color Renderer::GetColor(const NodeState state) {
             return {255, 255, 255, 255};
     }
 }
+
+int Renderer::GetPriority(const NodeState state) {
+    switch (state) {
+        case NodeState::Unvisited:
+            return 0;
+        case NodeState::Visited:
+            return 1;
+        case NodeState::Obstacle:
+            return 2;
+        case NodeState::InQueue:
+            return 3;
+        case NodeState::Processing:
+            return 4;
+        case NodeState::Path:
+            return 5;
+        case NodeState::Start:
+            return 6;
+        case NodeState::Target:
+            return 7;
+        default:
+            return 0;
+    }
+}
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <array>
+#include <vector>
+
+#include "Camera.hpp"
 #include "Graph.hpp"
 #include "SDL3/SDL.h"
 
@@ -7,10 +11,17 @@ class Renderer {
 public:
     explicit Renderer(SDL_Renderer* renderer);
 
-    void Render(const Graph& graph, int startIdx, int targetIdx) const;
+    void Render(const Graph& graph, const Camera& camera, int startIdx, int targetIdx) const;
 
 private:
+    static constexpr int kStateCount = static_cast<int>(NodeState::Target) + 1;
+
     SDL_Renderer* renderer_ = nullptr;
+    // Rects grouped by state so each colour is drawn with a single call; kept between frames to reuse storage.
+    mutable std::array<std::vector<SDL_FRect>, kStateCount> batches_;
+
+    void DrawMarker(const Graph& graph, const Camera& camera, int index) const;
 
     static SDL_Color GetColor(NodeState state);
+    static int GetPriority(NodeState state);
 };
@@ -2,10 +2,15 @@
 #include "SDL3/SDL.h"
 
 #include <algorithm>
-#include <random>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
 
+#include "Camera.hpp"
 #include "Dijkstra.hpp"
 #include "Graph.hpp"
+#include "MapGenerator.hpp"
 #include "Renderer.hpp"
 
 namespace {
@@ -16,45 +21,28 @@ constexpr int kDefaultDelayMs = 50;
 constexpr int kMinDelayMs = 1;
 constexpr int kMaxDelayMs = 500;
 constexpr int kDelayStepMs = 5;
-constexpr int kBlockCount = 6;
-constexpr int kBlockMinSize = 2;
-constexpr int kBlockMaxSize = 6;
-constexpr int kNoiseDivisor = 12;
+constexpr float kZoomStep = 1.25f;
+constexpr std::uint64_t kDefaultSeed = 1;
 }
 
-void AddRandomBlocks(Graph& graph, const int startIdx, const int targetIdx, const unsigned int seed) {
-    const int rows = graph.GetRows();
-    const int cols = graph.GetCols();
-
-    std::mt19937 rng(seed);
-    std::uniform_int_distribution rowDist(0, rows - 1);
-    std::uniform_int_distribution colDist(0, cols - 1);
-    std::uniform_int_distribution sizeDist(kBlockMinSize, kBlockMaxSize);
-
-    auto placeObstacle = [&](const int r, const int c) {
-        const int idx = graph.Index(r, c);
-        if (idx == startIdx || idx == targetIdx)
-            return;
-
-        Node& node = graph.GetNode(idx);
-        node.obstacle = true;
-        node.state = NodeState::Obstacle;
-    };
+void RegenerateMap(Graph& graph, const MapSettings& settings, const int startIdx, const int targetIdx) {
+    GenerateMap(graph, settings, startIdx, targetIdx);
+    SDL_Log("Map: %s, seed %llu", GetMapKindName(settings.kind), static_cast<unsigned long long>(settings.seed));
+}
 
-    for (int i = 0; i < kBlockCount; ++i) {
-        const int blockH = sizeDist(rng);
-        const int blockW = sizeDist(rng);
-        const int startR = rowDist(rng);
-        const int startC = colDist(rng);
+bool ParseSeed(const char* text, std::uint64_t& seed) {
+    // strtoull skips whitespace and accepts a sign, wrapping negative input, so require a leading digit.
+    if (!text || *text < '0' || *text > '9')
+        return false;
 
-        for (int r = startR; r < std::min(rows, startR + blockH); ++r)
-            for (int c = startC; c < std::min(cols, startC + blockW); ++c)
-                placeObstacle(r, c);
-    }
+    char* end = nullptr;
+    errno = 0;
+    const unsigned long long value = std::strtoull(text, &end, 10);
+    if (errno == ERANGE || *end != '\0')
+        return false;
 
-    const int noiseCount = rows * cols / kNoiseDivisor;
-    for (int i = 0; i < noiseCount; ++i)
-        placeObstacle(rowDist(rng), colDist(rng));
+    seed = value;
+    return true;
 }
 
 enum class AppState {
@@ -119,7 +107,14 @@ private:
     bool ok_ = false;
 };
 
-int main() {
+int main(const int argc, char* argv[]) {
+    MapSettings mapSettings;
+    mapSettings.seed = kDefaultSeed;
+    if (argc > 1 && !ParseSeed(argv[1], mapSettings.seed)) {
+        SDL_Log("Invalid seed '%s': expected a non-negative integer", argv[1]);
+        return 1;
+    }
+
     if (const SdlSystem sdl; !sdl.Ok())
         return 1;
 
@@ -130,9 +125,14 @@ int main() {
     Graph graph(kGridRows, kGridCols);
     int startIdx = 0;
     int targetIdx = graph.Index(kGridRows - 1, kGridCols - 1);
-    graph.ResetAll(startIdx, targetIdx);
-    AddRandomBlocks(graph, startIdx, targetIdx, SDL_GetTicks());
-    graph.ResetStatesKeepObstacles(startIdx, targetIdx);
+    RegenerateMap(graph, mapSettings, startIdx, targetIdx);
+
+    Camera camera;
+    int renderW = 0;
+    int renderH = 0;
+    SDL_GetRenderOutputSize(windowRenderer.Renderer(), &renderW, &renderH);
+    camera.FitToGrid(graph.GetRows(), graph.GetCols(), renderW, renderH);
+    bool cameraFitted = true;
 
     Renderer renderer(windowRenderer.Renderer());
     Dijkstra dijkstra;
@@ -150,7 +150,16 @@ int main() {
         while (SDL_PollEvent(&event)) {
             if (event.type == SDL_EVENT_QUIT)
                 running = false;
-            else if (event.type == SDL_EVENT_KEY_DOWN) {
+            else if (event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED) {
+                const int oldW = renderW;
+                const int oldH = renderH;
+                SDL_GetRenderOutputSize(windowRenderer.Renderer(), &renderW, &renderH);
+                // Follow the window while the view is untouched; otherwise keep the same cells centred.
+                if (cameraFitted)
+                    camera.FitToGrid(graph.GetRows(), graph.GetCols(), renderW, renderH);
+                else
+                    camera.Pan(static_cast<float>(renderW - oldW) / 2.0f, static_cast<float>(renderH - oldH) / 2.0f);
+            } else if (event.type == SDL_EVENT_KEY_DOWN) {
                 if (event.key.key == SDLK_ESCAPE)
                     running = false;
                 else if (event.key.key == SDLK_SPACE) {
@@ -161,10 +170,12 @@ int main() {
                         state = AppState::Running;
                         lastStepTicks = SDL_GetTicks();
                     }
-                } else if (event.key.key == SDLK_R) {
-                    graph.ResetAll(startIdx, targetIdx);
-                    AddRandomBlocks(graph, startIdx, targetIdx, SDL_GetTicks());
-                    graph.ResetStatesKeepObstacles(startIdx, targetIdx);
+                } else if (event.key.key == SDLK_R || event.key.key == SDLK_M) {
+                    if (event.key.key == SDLK_R)
+                        ++mapSettings.seed;
+                    else
+                        mapSettings.kind = NextMapKind(mapSettings.kind);
+                    RegenerateMap(graph, mapSettings, startIdx, targetIdx);
                     dijkstra.Reset();
                     path.clear();
                     pathIndex = 0;
@@ -180,30 +191,30 @@ int main() {
                         graph.SetDiagonal(!graph.IsDiagonalEnabled());
                         graph.ResetStatesKeepObstacles(startIdx, targetIdx);
                     }
+                } else if (event.key.key == SDLK_F) {
+                    SDL_GetRenderOutputSize(windowRenderer.Renderer(), &renderW, &renderH);
+                    camera.FitToGrid(graph.GetRows(), graph.GetCols(), renderW, renderH);
+                    cameraFitted = true;
                 } else if (event.key.key == SDLK_UP) {
                     delayMs = std::max(kMinDelayMs, delayMs - kDelayStepMs);
                 } else if (event.key.key == SDLK_DOWN) {
                     delayMs = std::min(kMaxDelayMs, delayMs + kDelayStepMs);
                 }
+            } else if (event.type == SDL_EVENT_MOUSE_WHEEL) {
+                camera.ZoomAt(std::pow(kZoomStep, event.wheel.y), event.wheel.mouse_x, event.wheel.mouse_y);
+                cameraFitted = false;
+            } else if (event.type == SDL_EVENT_MOUSE_MOTION) {
+                if (event.motion.state & SDL_BUTTON_MMASK) {
+                    camera.Pan(event.motion.xrel, event.motion.yrel);
+                    cameraFitted = false;
+                }
             } else if (event.type == SDL_EVENT_MOUSE_BUTTON_DOWN) {
-                if (state == AppState::Running)
+                if (state == AppState::Running || event.button.button == SDL_BUTTON_MIDDLE)
                     continue;
 
-                const int mouseX = static_cast<int>(event.button.x);
-                const int mouseY =static_cast<int>(event.button.y);
-                int renderW = 0;
-                int renderH = 0;
-                SDL_GetRenderOutputSize(windowRenderer.Renderer(), &renderW, &renderH);
-
-                const int cellSize = std::max(1, std::min(renderW / kGridCols, renderH / kGridRows));
-                const int gridW = cellSize * kGridCols;
-                const int gridH = cellSize * kGridRows;
-                const int offsetX = (renderW - gridW) / 2;
-                const int offsetY = (renderH - gridH) / 2;
-
-                const int col = (mouseX - offsetX) / cellSize;
-
-                if (const int row = (mouseY - offsetY) / cellSize; graph.InBounds(row, col)) {
+                int row = 0;
+                int col = 0;
+                if (camera.ScreenToCell(event.button.x, event.button.y, graph.GetRows(), graph.GetCols(), row, col)) {
                     const int index = graph.Index(row, col);
                     if (event.button.button == SDL_BUTTON_LEFT)
                         graph.ToggleObstacle(index, startIdx, targetIdx);
@@ -245,7 +256,7 @@ int main() {
             }
         }
 
-        renderer.Render(graph, startIdx, targetIdx);
+        renderer.Render(graph, camera, startIdx, targetIdx);
         SDL_Delay(1);
     }
 